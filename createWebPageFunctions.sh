@@ -53,6 +53,7 @@ EOL
 	    addScript ${dataFile} ${fileName}; 
 	done
 
+	echo '    <script src="../jsLibrary/functions_shards.js"></script>' >> ${fileName}
 	echo '    <script src="../jsLibrary/functions_'${typeTable}'.js"></script>' >> ${fileName}
     fi
 
@@ -68,6 +69,7 @@ EOL
         <td class="menuTD"><a href="../pwgSTAR/index.html">STAR PWGs</a></td>
 
         <td class="menuTD"><a href="../picoDstSTAR/index.html">STAR picoDSTs</a></td>
+        <td class="menuTD"><a href="../stats/index.html">Access age / largest files</a></td>
 
      </tr>
       <tr>
@@ -78,6 +80,7 @@ EOL
 
         <td class="menuTD">&nbsp;</td>
         <td class="menuTD"><a href="../picoDstSTAR/indexExt.html">STAR picoDSTs extended</a></td>
+        <td class="menuTD"><a href="../stats/indexExt.html">Owners</a></td>
 
      </tr>
     </table>
@@ -242,6 +245,119 @@ function printTable() {
     echo '</tfoot></table>' >> ${fileName}
 }
 
+# -----------------------------------------------------------------------------------------------------------------
+function printStatsTable() {
+    typeStats=$1
+    name=$2
+    fileName=$3
+
+    tableName=output/outfile_Table_${typeStats}_${name}
+
+    if [ ! -f ${tableName}.txt ] ; then
+	echo '<p>No table available.</p>' >> ${fileName}
+	return
+    fi
+
+    # -- HEAD -------------------------------------------------------
+    echo '<table class="sortable" cellspacing="0" cellpadding="2"><thead>' >> ${fileName}
+
+    if [ "${typeStats}" = "Age" ] ; then
+	echo '<tr><th class="user">Folder</th>' >> ${fileName}
+	echo '<th class="size">&lt; 30 days (GB)</th><th class="size">30 - 90 days (GB)</th><th class="size">90 - 180 days (GB)</th>' >> ${fileName}
+	echo '<th class="size">180 days - 1 year (GB)</th><th class="size">1 - 2 years (GB)</th><th class="size">&gt; 2 years (GB)</th>' >> ${fileName}
+	echo '<th class="size">Size (GB)</th></tr>' >> ${fileName}
+    elif [ "${typeStats}" = "TopFiles" ] ; then
+	echo '<tr><th class="user">File</th><th class="user">User</th>' >> ${fileName}
+	echo '<th class="size">Size (GB)</th><th class="time">Last Mod.</th><th class="time">Last Access</th></tr>' >> ${fileName}
+    elif [ "${typeStats}" = "Uid" ] ; then
+	echo '<tr><th class="user">Folder</th><th class="user">User</th><th class="size">Size (GB)</th><th class="nFiles">N Files</th></tr>' >> ${fileName}
+    elif [ "${typeStats}" = "Gid" ] ; then
+	echo '<tr><th class="user">Folder</th><th class="user">Group</th><th class="size">Size (GB)</th><th class="nFiles">N Files</th></tr>' >> ${fileName}
+    fi
+
+    echo '</thead>' >> ${fileName}
+
+    # -- BODY -------------------------------------------------------
+    echo '<tbody>' >> ${fileName}
+    cat ${tableName}.txt >> ${fileName}
+    echo '</tbody>' >> ${fileName}
+
+    # -- FOOT -------------------------------------------------------
+    if [ -f ${tableName}_Sum.txt ] ; then
+	echo '<tfoot>' >> ${fileName}
+	cat ${tableName}_Sum.txt >> ${fileName}
+	echo '</tfoot>' >> ${fileName}
+    fi
+
+    echo '</table>' >> ${fileName}
+}
+
+# -----------------------------------------------------------------------------------------------------------------
+function printStats() {
+    typeTable=stats
+    fileName=www/${1}/index.html
+
+    printBegin ${typeTable} ${fileName} NONE
+
+    echo '    <table width="100%" cellspacing="0" cellpadding="10"><tr>' >> ${fileName}
+    echo '    <td class="halfColumn" style="width: 90%">' >> ${fileName}
+
+    # -- size by last access and largest files of the trees 
+    for name in alice_user rnc_user embeddingv1 picodstsv1 pwgstar ; do 
+	if [ "${name}" = "alice_user" ] ; then
+	    title="ALICE users"
+	elif [ "${name}" = "rnc_user" ] ; then
+	    title="RNC users"
+	elif [ "${name}" = "embeddingv1" ] ; then
+	    title="STAR embedding"
+	elif [ "${name}" = "picodstsv1" ] ; then
+	    title="STAR picoDsts"
+	elif [ "${name}" = "pwgstar" ] ; then
+	    title="STAR PWG directories"
+	fi
+
+	echo '      <h3><span style="font-style:italic">'${title}'</span> at NERSC</h3>' >> ${fileName}
+	echo '      <h4>size by last access</h4>' >> ${fileName}
+	printStatsTable Age ${name} ${fileName}
+	echo '      <h4>largest files</h4>' >> ${fileName}
+	printStatsTable TopFiles ${name} ${fileName}
+
+	printLine ${fileName}    
+    done
+
+    echo '    </td><td class="halfColumn" style="width:10%">&nbsp;</td></tr></table>' >> ${fileName}
+
+    printEnd ${fileName}
+
+    # -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- -- --
+
+    fileName=www/${1}/indexExt.html
+
+    printBegin ${typeTable} ${fileName} NONE
+
+    echo '    <table width="100%" cellspacing="0" cellpadding="10"><tr>' >> ${fileName}
+    echo '    <td class="halfColumn" style="width: 45%">' >> ${fileName}
+    echo '      <h3>Users of the top-level folders</h3>' >> ${fileName}
+
+    # -- owners of the top-level folders of every fileset
+    for fileset in `grep -v "^#" filesets.txt | awk 'NF >= 2 { print $1"_"$2 }'` ; do 
+	echo '      <h4>'${fileset#*_}' of '${fileset%%_*}'</h4>' >> ${fileName}
+	printStatsTable Uid ${fileset} ${fileName}
+    done
+
+    echo '    </td><td class="halfColumn" style="width: 45%">' >> ${fileName}
+    echo '      <h3>Groups of the top-level folders</h3>' >> ${fileName}
+
+    for fileset in `grep -v "^#" filesets.txt | awk 'NF >= 2 { print $1"_"$2 }'` ; do 
+	echo '      <h4>'${fileset#*_}' of '${fileset%%_*}'</h4>' >> ${fileName}
+	printStatsTable Gid ${fileset} ${fileName}
+    done
+
+    echo '    </td><td class="halfColumn" style="width:10%">&nbsp;</td></tr></table>' >> ${fileName}
+
+    printEnd ${fileName}
+}
+
 # -----------------------------------------------------------------------------------------------------------------
 function printUserRNC() {
     typeTable=rnc_user
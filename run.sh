@@ -13,7 +13,15 @@ BASEPATH=$PWD
 
 reCreateTree=0
 
-# -- Setup scratch space for reduced GPFS dump output
+# -- number of threads used for parsing
+nThreads=`nproc`
+
+# -- update the trees incrementally from the previous snapshot
+#    (keeps incrementalState_*.bin, growthHistory_*.txt is 
+#     appended in both cases)
+incremental=0
+
+# -- Setup scratch space for links to the GPFS dumps
 if [ -z "$SCRATCH" ] ; then 
     SCRATCH="/scratch/`whoami`"
 fi
@@ -28,13 +36,14 @@ fi
 pushd ${BASEPATH} > /dev/null
 inputPath=/project/statistics/LIST
 
-# -- get latest PROJECT/PROJECTA folder
-for prjFolder in project projecta  ; do
+# -- get latest folder of every storage in filesets.txt
+for prjFolder in `grep -v "^#" ${BASEPATH}/filesets.txt | awk 'NF >= 2 && !seen[$1]++ { print $1 }'` ; do
 
-    if [ "${prjFolder}" == "project" ] ; then 
-	prjPath=tlproject2
-    elif [ "${prjFolder}" == "projecta" ] ; then 
-	prjPath=tlprojecta
+    # -- folder of the dumps of the storage
+    prjPath=`grep -v "^#" ${BASEPATH}/filesets.txt | awk -v storage=${prjFolder} '$1 == storage && NF >= 3 { print $3; exit }'`
+    if [ -z "${prjPath}" ] ; then
+	echo "Error: no folder of the dumps for storage ${prjFolder} in ${BASEPATH}/filesets.txt"
+	exit 1
     fi
     
     projectFolders=`ls -t ${inputPath}/${prjPath}/ | head -n 10 | sort -r 2> /dev/null`
@@ -52,6 +61,20 @@ for prjFolder in project projecta  ; do
 	    continue
 	fi
 
+	# -- Create input files for parsing
+	#    every storage is linked, also unchanged ones : 
+	#    all storages are parsed if one of them changed
+	# ----------------------------------------------
+	
+	# -- Get folders for local input files
+	prjFolderLocal=${SCRATCHPATH}/${prjFolder}
+	mkdir -p ${prjFolderLocal}
+	ln -sfn ${prjFolderLocal} ${prjFolder}
+
+	# -- Link raw dump as input, parseGPFSDump.C splits it into 
+	#    the filesets of filesets.txt in a single pass
+	ln -sf ${inFile} ${prjFolder}/allfiles.list
+
 	# -- Get old modification dates and check if tree recreation has to be run
 	if [ -f modDate_${prjFolder}.txt ] ; then 
 	    oldmodDate=`cat modDate_${prjFolder}.txt`
@@ -61,34 +84,9 @@ for prjFolder in project projecta  ; do
 	fi
 	
 	reCreateTree=1
-	
-	# -- Create input files for parsing
-	# ----------------------------------------------
-	
-	# -- Get folders for local input files
-	prjFolderLocal=${SCRATCHPATH}/${prjFolder}
-	if [ -d ${prjFolderLocal} ] ; then 
-	    rm -rf ${prjFolderLocal}
-	fi 
-	   
-	mkdir -p ${prjFolderLocal}
-	ln -sf ${prjFolderLocal} ${prjFolder}
-
-	# -- Get input files for parsing
-
-	if [ "${prjFolder}" == "project" ] ; then 
-	    cat ${inFile} | grep "%2Fprojectdirs%2Fstarprod%2F" > ${prjFolder}/prj-starprod.list
-	    sed -i "s/%2F${prjFolder}%2F.snapshots%2F${folder}%2Fprojectdirs%2F//" ${prjFolder}/prj-starprod.list
-
-	    cat ${inFile} | grep "%2Fprojectdirs%2Fstar%2F" > ${prjFolder}/prj-star.list
-	    sed -i "s/%2F${prjFolder}%2F.snapshots%2F${folder}%2Fprojectdirs%2F//" ${prjFolder}/prj-star.list
-	    
-	    cat ${inFile} | grep "%2Fprojectdirs%2Falice%2F" > ${prjFolder}/prj-alice.list
-	    sed -i "s/%2F${prjFolder}%2F.snapshots%2F${folder}%2Fprojectdirs%2F//" ${prjFolder}/prj-alice.list
-	else
-	    cat ${inFile} | grep "%2Fprojectdirs%2Fstarprod%2F" > ${prjFolder}/prj-starprod.list
-	    sed -i "s/%2Fglobal%2F${prjFolder}%2F.snapshots%2F${folder}%2Fprojectdirs%2F//" ${prjFolder}/prj-starprod.list
-	fi
+
+	# -- remove prefiltered lists of older versions
+	rm -f ${prjFolderLocal}/prj-*.list
 
 	echo $folder > modDate_${prjFolder}.txt
 
@@ -107,7 +105,11 @@ if [ $reCreateTree -eq 1 ] ; then
     mkdir -p output
 
     # -- run script
-    ${BASEPATH}/parseGPFSDump.tcsh ${BASEPATH} 2
+    if [ $incremental -eq 1 ] ; then
+	${BASEPATH}/parseGPFSDump.tcsh ${BASEPATH} 3
+    else
+	${BASEPATH}/parseGPFSDump.tcsh ${BASEPATH} 2 ${nThreads}
+    fi
 fi
 
 # -- create html
@@ -0,0 +1,84 @@
+#!/bin/bash
+#
+# Benchmark parsing and printing on synthetic GPFS dumps
+#
+# Usage: runBenchmark.sh <BASEPATH> [<nFiles>] [<nThreads>] [<width>] [<depth>] [<skew>] [<seed>]
+#
+###################################################
+
+BASEPATH=$1
+
+if [ -z "$BASEPATH" ] ; then
+    echo "Usage: $0 <BASEPATH> [<nFiles>] [<nThreads>] [<width>] [<depth>] [<skew>] [<seed>]"
+    exit 1
+fi
+
+# -- files per FileSystem
+nFiles=${2:-1000000}
+
+# -- number of threads used for parsing
+nThreads=${3:-`nproc`}
+
+# -- children per folder level, max depth below an area and
+#    skew of the distribution of files over the children
+width=${4:-20}
+depth=${5:-8}
+skew=${6:-1.}
+
+# -- seed of the generator, same seed - same dumps
+seed=${7:-4357}
+
+snapshot=2016-02-22
+
+# -- Setup benchmark folder, runs on its own inputs and outputs
+BENCHPATH=${BASEPATH}/benchmark
+
+if [ ! -d ${BENCHPATH}/output ] ; then
+    mkdir -p ${BENCHPATH}/output
+fi
+
+pushd ${BENCHPATH} > /dev/null
+
+cp ${BASEPATH}/filesets.txt .
+rm -f runSummary.txt
+
+# -- generate dumps
+idxStorage=0
+for prjFolder in project projecta ; do
+    if [ ! -d ${prjFolder} ] ; then
+	mkdir -p ${prjFolder}
+    fi
+    echo ${snapshot} > modDate_${prjFolder}.txt
+
+    root -b -l -q "${BASEPATH}/generateGPFSDump.C+(${idxStorage},${nFiles},${width},${depth},${skew},$((seed+idxStorage)),\"${snapshot}\")"
+    let idxStorage=idxStorage+1
+done
+
+# -- parse and print
+root -b -l -q "${BASEPATH}/parseGPFSDump.C+(2,0,0,${nThreads})"
+root -b -l -q "${BASEPATH}/parseGPFSDump.C+(2,1,0,${nThreads})"
+
+root -b -l -q "${BASEPATH}/parseGPFSDump.C+(1)"
+
+# -- report runSummary.txt
+echo ""
+echo "Benchmark : ${nFiles} files per FileSystem, ${nThreads} threads, width ${width}, depth ${depth}, skew ${skew}, seed ${seed}"
+echo ""
+
+awk '{
+    for (idx = 2; idx <= NF; ++idx) {
+	split($idx, entry, "=")
+	value[entry[1]] = entry[2]
+    }
+    printf("%-8s mode %s : %10d lines %8d malformed %10.0f lines/s %10d nodes %8.1f MB peak RSS %8.2f s\n",
+	   value["storage"], value["mode"], value["lines"], value["malformed"], value["linesPerSec"],
+	   value["nodes"], value["maxRSS_kB"]/1024., value["wall_total"])
+    nPhases = split("parse merge export write read views print other", phase, " ")
+    printf("         wall [s]   :")
+    for (idx = 1; idx <= nPhases; ++idx)
+	printf(" %s %.3f", phase[idx], value["wall_" phase[idx]])
+    printf("\n         cpu  [s]   : tokenize %.3f prefilter %.3f insert %.3f\n",
+	   value["cpu_tokenize"], value["cpu_prefilter"], value["cpu_insert"])
+}' runSummary.txt
+
+popd > /dev/null
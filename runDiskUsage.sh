@@ -16,7 +16,7 @@ source ${BASEPATH}/createWebPageFunctions.sh
 
 now=`date +'%F %H:%m'`
 
-folderList="data overview embedding picoDstSTAR pwgSTAR userRNC userALICE"
+folderList="data overview embedding picoDstSTAR pwgSTAR userRNC userALICE stats"
 
 # -- Get modification dates
 modDatePROJECT=`cat modDate_project.txt`
@@ -65,10 +65,21 @@ if [ ! -d ${wwwPath} ] ; then
     fi
 fi
 
+# -- update page functions and the shared helper, which loads the subtrees of the trees
+cp ${BASEPATH}/www-template/jsLibrary/functions_*.js ${wwwPath}/jsLibrary/
+
 # -- cp output to www
 cp output/outfile*.js www/data
 chmod 644 www/data/outfile*.js
 
+# -- cp subtrees to www, loaded on expand
+rm -rf www/data/outfile_*/
+for shardDir in `find output -mindepth 1 -maxdepth 1 -type d -name "outfile_*"` ; do
+    cp -r ${shardDir} www/data/
+    chmod 755 www/data/`basename ${shardDir}`
+    chmod 644 www/data/`basename ${shardDir}`/*.json
+done
+
 # -- Create webpages
 pushd www > /dev/null
 for ii in ${folderList} ; do 
@@ -86,6 +97,8 @@ printUserALICE userALICE
 printPwgSTAR pwgSTAR
 printPicoDSTs picoDstSTAR
 
+printStats stats
+
 pushd www > /dev/null
 for ii in ${folderList} ; do 
     chmod 644 ${ii}/*.*
@@ -3,6 +3,7 @@
 $(function() {
     $('#aliceUser').tree({
 	data: alice_userDATA,
+	dataUrl: shardUrl('alice_user'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
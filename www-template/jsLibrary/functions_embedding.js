@@ -3,6 +3,7 @@
 $(function() {
     $('#embeddingv1').tree({
 	data: embeddingv1DATA,
+	dataUrl: shardUrl('embeddingv1'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -13,6 +14,7 @@ $(function() {
 $(function() {
     $('#embeddingv2').tree({
 	data: embeddingv2DATA,
+	dataUrl: shardUrl('embeddingv2'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -3,6 +3,7 @@
 $(function() {
     $('#aliceUser').tree({
 	data: alice_userDATA,
+	dataUrl: shardUrl('alice_user'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -15,6 +16,7 @@ $(function() {
 $(function() {
     $('#embeddingv1').tree({
 	data: embeddingv1DATA,
+	dataUrl: shardUrl('embeddingv1'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -25,6 +27,7 @@ $(function() {
 $(function() {
     $('#embeddingv2').tree({
 	data: embeddingv2DATA,
+	dataUrl: shardUrl('embeddingv2'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -37,6 +40,7 @@ $(function() {
 $(function() {
     $('#rncUser').tree({
 	data: rnc_userDATA,
+	dataUrl: shardUrl('rnc_user'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -50,6 +54,7 @@ $(function() {
 $(function() {
     $('#pwgSTAR').tree({
 	data: pwgstarDATA,
+	dataUrl: shardUrl('pwgstar'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -62,6 +67,7 @@ $(function() {
 $(function() {
     $('#picoDstsv1').tree({
 	data: picodstsv1DATA,
+	dataUrl: shardUrl('picodstsv1'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -72,6 +78,7 @@ $(function() {
 $(function() {
     $('#picoDstsv2').tree({
 	data: picodstsv2DATA,
+	dataUrl: shardUrl('picodstsv2'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -82,6 +89,7 @@ $(function() {
 $(function() {
     $('#picoDstsv3').tree({
 	data: picodstsv3DATA,
+	dataUrl: shardUrl('picodstsv3'),
 	autoEscape: false,
 	autoOpen: 0,
 	closedIcon: '+',
@@ -3,6 +3,7 @@
 $(function() {
     $('#project_alice').tree({
 	data: project_aliceDATA,
+	dataUrl: shardUrl('project_alice'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -13,6 +14,7 @@ $(function() {
 $(function() {
     $('#project_star').tree({
 	data: project_starDATA,
+	dataUrl: shardUrl('project_star'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -24,6 +26,7 @@ $(function() {
 $(function() {
     $('#project_starprod').tree({
 	data: project_starprodDATA,
+	dataUrl: shardUrl('project_starprod'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -34,6 +37,7 @@ $(function() {
 $(function() {
     $('#projecta_starprod').tree({
 	data: projecta_starprodDATA,
+	dataUrl: shardUrl('projecta_starprod'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -46,6 +50,7 @@ $(function() {
 $(function() {
     $('#project').tree({
 	data: projectDATA,
+	dataUrl: shardUrl('project'),
 	autoEscape: false,
 	autoOpen: 0,
 	closedIcon: '+',
@@ -56,6 +61,7 @@ $(function() {
 $(function() {
     $('#projecta').tree({
 	data: projectaDATA,
+	dataUrl: shardUrl('projecta'),
 	autoEscape: false,
 	autoOpen: 0,
 	closedIcon: '+',
@@ -3,6 +3,7 @@
 $(function() {
     $('#picoDstsv1').tree({
 	data: picodstsv1DATA,
+	dataUrl: shardUrl('picodstsv1'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -13,6 +14,7 @@ $(function() {
 $(function() {
     $('#picoDstsv2').tree({
 	data: picodstsv2DATA,
+	dataUrl: shardUrl('picodstsv2'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -23,6 +25,7 @@ $(function() {
 $(function() {
     $('#picoDstsv3').tree({
 	data: picodstsv3DATA,
+	dataUrl: shardUrl('picodstsv3'),
 	autoEscape: false,
 	autoOpen: 0,
 	closedIcon: '+',
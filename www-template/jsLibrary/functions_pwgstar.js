@@ -3,6 +3,7 @@
 $(function() {
     $('#pwgSTAR').tree({
 	data: pwgstarDATA,
+	dataUrl: shardUrl('pwgstar'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -3,6 +3,7 @@
 $(function() {
     $('#rncUser').tree({
 	data: rnc_userDATA,
+	dataUrl: shardUrl('rnc_user'),
 	autoEscape: false,
 	autoOpen: false,
 	closedIcon: '+',
@@ -0,0 +1,12 @@
+// ---------------------------------------------------------
+// -- subtrees are loaded on expand from outfile_<name>/<id>.json
+//    next to outfile_<name>.js
+
+function shardUrl(name) {
+    var script = $('script[src$="outfile_' + name + '.js"]').attr('src');
+    return function(node) {
+	return script.replace(/\.js$/, '/') + node.id + '.json';
+    };
+}
+
+// ---------------------------------------------------------